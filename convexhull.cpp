@@ -0,0 +1,341 @@
+#include "convexhull.h"
+#include <QHash>
+#include <QPair>
+#include <QThread>
+#include <QtConcurrent/QtConcurrent>
+#include <cfloat>
+#include <cmath>
+
+namespace {
+
+// Точка в двойной точности, чтобы проверки "выше/ниже плоскости" были устойчивыми
+struct Vec
+{
+    double x, y, z;
+
+    Vec operator-(const Vec &o) const { return { x - o.x, y - o.y, z - o.z }; }
+    double dot(const Vec &o) const { return x * o.x + y * o.y + z * o.z; }
+    Vec cross(const Vec &o) const { return { y * o.z - z * o.y, z * o.x - x * o.z, x * o.y - y * o.x }; }
+    double length() const { return std::sqrt(dot(*this)); }
+};
+
+Vec toVec(const QVector3D &v) {
+    return { v.x(), v.y(), v.z() };
+}
+
+// Грань оболочки. Ребро k идет из v[k] в v[(k + 1) % 3],
+// neighbor[k] - грань, смежная по этому ребру.
+struct Face
+{
+    int v[3];
+    int neighbor[3];
+    Vec normal;
+    double offset;
+    bool alive;
+    QVector<int> outside; // Точки, лежащие снаружи грани
+};
+
+// Часть входных точек для параллельного распределения по граням
+struct Chunk
+{
+    int begin;
+    int end;
+    QVector<int> outside[4];
+};
+
+class QuickHull
+{
+public:
+    QuickHull(const QVector<QVector3D> &points) : points(points) {}
+    bool build();
+    void collect(QVector<QVector3D> &hullVertices, QVector<QVector<int>> &hullFaces) const;
+
+private:
+    Vec at(int i) const { return toVec(points[i]); }
+    double distance(const Face &face, int i) const { return face.normal.dot(at(i)) - face.offset; }
+    int addFace(int a, int b, int c);
+    bool buildSimplex(int simplex[4]);
+    void addPoint(int faceIndex);
+    int findNeighborEdge(int faceIndex, int neighborIndex) const;
+
+    const QVector<QVector3D> &points;
+    QVector<Face> faces;
+    double epsilon = 0.0;
+};
+
+int QuickHull::addFace(int a, int b, int c) {
+    Face face;
+    face.v[0] = a;
+    face.v[1] = b;
+    face.v[2] = c;
+    face.neighbor[0] = face.neighbor[1] = face.neighbor[2] = -1;
+    face.normal = (at(b) - at(a)).cross(at(c) - at(a));
+    double length = face.normal.length();
+    if (length > 0) {
+        face.normal = { face.normal.x / length, face.normal.y / length, face.normal.z / length };
+    }
+    face.offset = face.normal.dot(at(a));
+    face.alive = true;
+    faces.append(face);
+    return faces.size() - 1;
+}
+
+int QuickHull::findNeighborEdge(int faceIndex, int neighborIndex) const {
+    for (int k = 0; k < 3; ++k) {
+        if (faces[faceIndex].neighbor[k] == neighborIndex) return k;
+    }
+    return -1;
+}
+
+// Начальный тетраэдр из крайних точек набора
+bool QuickHull::buildSimplex(int simplex[4]) {
+    // Крайние точки по осям координат
+    int extremes[6] = { 0, 0, 0, 0, 0, 0 };
+    double scale = 0.0;
+    for (int i = 0; i < points.size(); ++i) {
+        const QVector3D &p = points[i];
+        for (int axis = 0; axis < 3; ++axis) {
+            if (p[axis] < points[extremes[2 * axis]][axis]) extremes[2 * axis] = i;
+            if (p[axis] > points[extremes[2 * axis + 1]][axis]) extremes[2 * axis + 1] = i;
+        }
+    }
+    for (int axis = 0; axis < 3; ++axis) {
+        scale += qMax(std::abs(points[extremes[2 * axis]][axis]), std::abs(points[extremes[2 * axis + 1]][axis]));
+    }
+    epsilon = 3 * FLT_EPSILON * scale;
+
+    // Две наиболее удаленные друг от друга крайние точки
+    double best = -1.0;
+    for (int i = 0; i < 6; ++i) {
+        for (int j = i + 1; j < 6; ++j) {
+            double d = (at(extremes[i]) - at(extremes[j])).length();
+            if (d > best) {
+                best = d;
+                simplex[0] = extremes[i];
+                simplex[1] = extremes[j];
+            }
+        }
+    }
+    if (best <= epsilon) return false;
+
+    // Точка, наиболее удаленная от прямой
+    Vec a = at(simplex[0]);
+    Vec direction = at(simplex[1]) - a;
+    best = 0.0;
+    for (int i = 0; i < points.size(); ++i) {
+        double d = direction.cross(at(i) - a).length() / direction.length();
+        if (d > best) {
+            best = d;
+            simplex[2] = i;
+        }
+    }
+    if (best <= epsilon) return false;
+
+    // Точка, наиболее удаленная от плоскости
+    Vec normal = direction.cross(at(simplex[2]) - a);
+    normal = { normal.x / normal.length(), normal.y / normal.length(), normal.z / normal.length() };
+    best = 0.0;
+    for (int i = 0; i < points.size(); ++i) {
+        double d = std::abs(normal.dot(at(i) - a));
+        if (d > best) {
+            best = d;
+            simplex[3] = i;
+        }
+    }
+    return best > epsilon;
+}
+
+bool QuickHull::build() {
+    if (points.size() < 4) return false;
+
+    int s[4];
+    if (!buildSimplex(s)) return false;
+
+    // Ориентируем тетраэдр так, чтобы нормали граней смотрели наружу
+    if ((at(s[1]) - at(s[0])).cross(at(s[2]) - at(s[0])).dot(at(s[3]) - at(s[0])) > 0) {
+        std::swap(s[1], s[2]);
+    }
+    int f0 = addFace(s[0], s[1], s[2]);
+    int f1 = addFace(s[0], s[3], s[1]);
+    int f2 = addFace(s[1], s[3], s[2]);
+    int f3 = addFace(s[2], s[3], s[0]);
+    int links[4][3] = { { f1, f2, f3 }, { f3, f2, f0 }, { f1, f3, f0 }, { f2, f1, f0 } };
+    for (int f = 0; f < 4; ++f) {
+        for (int k = 0; k < 3; ++k) {
+            faces[f].neighbor[k] = links[f][k];
+        }
+    }
+
+    // Распределяем точки по граням тетраэдра параллельно.
+    // Точки внутри тетраэдра сразу отбрасываются, что обычно удаляет большую часть набора.
+    int chunkCount = qMax(1, QThread::idealThreadCount() * 4);
+    int chunkSize = (points.size() + chunkCount - 1) / chunkCount;
+    QVector<Chunk> chunks;
+    for (int begin = 0; begin < points.size(); begin += chunkSize) {
+        Chunk chunk;
+        chunk.begin = begin;
+        chunk.end = qMin(begin + chunkSize, int(points.size()));
+        chunks.append(chunk);
+    }
+    QtConcurrent::blockingMap(chunks, [this](Chunk &chunk) {
+        for (int i = chunk.begin; i < chunk.end; ++i) {
+            for (int f = 0; f < 4; ++f) {
+                if (distance(faces.at(f), i) > epsilon) {
+                    chunk.outside[f].append(i);
+                    break;
+                }
+            }
+        }
+    });
+    for (const Chunk &chunk : chunks) {
+        for (int f = 0; f < 4; ++f) {
+            faces[f].outside.append(chunk.outside[f]);
+        }
+    }
+
+    // Пока есть грани с внешними точками, добавляем в оболочку самую удаленную из них
+    QVector<int> pending = { f0, f1, f2, f3 };
+    while (!pending.isEmpty()) {
+        int f = pending.last();
+        pending.removeLast();
+        if (!faces[f].alive || faces[f].outside.isEmpty()) continue;
+
+        int firstNew = faces.size();
+        addPoint(f);
+        for (int n = firstNew; n < faces.size(); ++n) {
+            if (!faces[n].outside.isEmpty()) pending.append(n);
+        }
+    }
+    return true;
+}
+
+// Добавление в оболочку самой удаленной внешней точки грани
+void QuickHull::addPoint(int faceIndex) {
+    // Самая удаленная точка
+    int eye = faces[faceIndex].outside[0];
+    double best = distance(faces[faceIndex], eye);
+    for (int i : faces[faceIndex].outside) {
+        double d = distance(faces[faceIndex], i);
+        if (d > best) {
+            best = d;
+            eye = i;
+        }
+    }
+
+    // Обход видимых из точки граней в глубину. Ребра горизонта
+    // собираются в порядке обхода и образуют замкнутую цепочку.
+    struct Frame
+    {
+        int face;
+        int firstEdge;
+        int step;
+    };
+    QVector<int> visible = { faceIndex };
+    QVector<QPair<int, int>> horizon; // Грань и номер ребра
+    QVector<Frame> stack = { { faceIndex, 0, 0 } };
+    faces[faceIndex].alive = false;
+    while (!stack.isEmpty()) {
+        Frame &frame = stack.last();
+        if (frame.step == 3) {
+            stack.removeLast();
+            continue;
+        }
+        int current = frame.face;
+        int k = (frame.firstEdge + frame.step) % 3;
+        ++frame.step;
+
+        int neighbor = faces[current].neighbor[k];
+        if (!faces[neighbor].alive) continue;
+        if (distance(faces[neighbor], eye) > 0) {
+            faces[neighbor].alive = false;
+            visible.append(neighbor);
+            stack.append({ neighbor, (findNeighborEdge(neighbor, current) + 1) % 3, 0 });
+        } else {
+            horizon.append(qMakePair(current, k));
+        }
+    }
+
+    // Новые грани из ребер горизонта и добавленной точки
+    int firstNew = faces.size();
+    for (const QPair<int, int> &edge : horizon) {
+        int a = faces[edge.first].v[edge.second];
+        int b = faces[edge.first].v[(edge.second + 1) % 3];
+        int opposite = faces[edge.first].neighbor[edge.second];
+
+        int created = addFace(a, b, eye);
+        faces[created].neighbor[0] = opposite;
+        faces[opposite].neighbor[findNeighborEdge(opposite, edge.first)] = created;
+    }
+    int count = horizon.size();
+    for (int i = 0; i < count; ++i) {
+        int current = firstNew + i;
+        int next = firstNew + (i + 1) % count;
+        faces[current].neighbor[1] = next;
+        faces[next].neighbor[2] = current;
+    }
+
+    // Перераспределяем внешние точки удаленных граней
+    for (int f : visible) {
+        QVector<int> outside;
+        outside.swap(faces[f].outside);
+        for (int i : outside) {
+            if (i == eye) continue;
+            for (int n = firstNew; n < faces.size(); ++n) {
+                if (distance(faces[n], i) > epsilon) {
+                    faces[n].outside.append(i);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// Сбор оболочки: только живые грани и используемые ими вершины
+void QuickHull::collect(QVector<QVector3D> &hullVertices, QVector<QVector<int>> &hullFaces) const {
+    QHash<int, int> remap;
+    for (const Face &face : faces) {
+        if (!face.alive) continue;
+        QVector<int> hullFace;
+        for (int k = 0; k < 3; ++k) {
+            int index = remap.value(face.v[k], -1);
+            if (index < 0) {
+                index = hullVertices.size();
+                remap.insert(face.v[k], index);
+                hullVertices.append(points[face.v[k]]);
+            }
+            hullFace.append(index);
+        }
+        hullFaces.append(hullFace);
+    }
+}
+
+} // namespace
+
+// Конструктор класса ConvexHull
+ConvexHull::ConvexHull() {}
+
+// Метод для построения выпуклой оболочки. Для вырожденного
+// (плоского или пустого) набора точек возвращается пустая оболочка.
+ConvexHull ConvexHull::compute(const QVector<QVector3D> &points) {
+    ConvexHull hull;
+    QuickHull quickHull(points);
+    if (quickHull.build()) {
+        quickHull.collect(hull.vertices, hull.faces);
+    }
+    return hull;
+}
+
+// Метод для проверки, построена ли оболочка
+bool ConvexHull::isEmpty() const {
+    return faces.isEmpty();
+}
+
+// Метод для получения списка вершин оболочки
+const QVector<QVector3D>& ConvexHull::getVertices() const {
+    return vertices;
+}
+
+// Метод для получения списка граней оболочки
+const QVector<QVector<int>>& ConvexHull::getFaces() const {
+    return faces;
+}
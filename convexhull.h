@@ -0,0 +1,22 @@
+#ifndef CONVEXHULL_H
+#define CONVEXHULL_H
+
+#include <QVector>
+#include <QVector3D>
+
+class ConvexHull
+{
+public:
+    ConvexHull();
+    // Построение выпуклой оболочки набора точек (алгоритм Quickhull)
+    static ConvexHull compute(const QVector<QVector3D> &points);
+    bool isEmpty() const;
+    const QVector<QVector3D>& getVertices() const;
+    const QVector<QVector<int>>& getFaces() const;
+
+private:
+    QVector<QVector3D> vertices; // Вершины оболочки
+    QVector<QVector<int>> faces; // Треугольные грани, нормали направлены наружу
+};
+
+#endif // CONVEXHULL_H
@@ -0,0 +1,62 @@
+#include "deviation.h"
+#include "trianglebvh.h"
+#include <QThread>
+#include <QtConcurrent/QtConcurrent>
+#include <cmath>
+
+namespace {
+
+// Часть вершин модели для параллельной обработки
+struct Chunk
+{
+    int begin;
+    int end;
+    double max = 0.0;
+    double sum = 0.0;
+    double sumSquares = 0.0;
+};
+
+} // namespace
+
+// Метод для вычисления отклонений. Поверхность эталона раскладывается в дерево
+// ограничивающих объемов, после чего вершины модели обрабатываются параллельно.
+DeviationResult Deviation::compute(const Model &model, const Model &reference) {
+    DeviationResult result;
+    const QVector<QVector3D> &vertices = model.getVertices();
+    TriangleBVH bvh(reference);
+    if (vertices.isEmpty() || bvh.isEmpty()) return result;
+
+    result.distances.resize(vertices.size());
+    float *distances = result.distances.data();
+
+    int chunkCount = qMax(1, QThread::idealThreadCount() * 8);
+    int chunkSize = (vertices.size() + chunkCount - 1) / chunkCount;
+    QVector<Chunk> chunks;
+    for (int begin = 0; begin < vertices.size(); begin += chunkSize) {
+        Chunk chunk;
+        chunk.begin = begin;
+        chunk.end = qMin(begin + chunkSize, int(vertices.size()));
+        chunks.append(chunk);
+    }
+
+    QtConcurrent::blockingMap(chunks, [&](Chunk &chunk) {
+        for (int i = chunk.begin; i < chunk.end; ++i) {
+            float distance = bvh.closestDistance(vertices[i]);
+            distances[i] = distance;
+            chunk.max = qMax(chunk.max, double(distance));
+            chunk.sum += distance;
+            chunk.sumSquares += double(distance) * distance;
+        }
+    });
+
+    double sum = 0.0;
+    double sumSquares = 0.0;
+    for (const Chunk &chunk : chunks) {
+        result.maxDistance = qMax(result.maxDistance, chunk.max);
+        sum += chunk.sum;
+        sumSquares += chunk.sumSquares;
+    }
+    result.meanDistance = sum / vertices.size();
+    result.rmsDistance = std::sqrt(sumSquares / vertices.size());
+    return result;
+}
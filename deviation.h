@@ -0,0 +1,23 @@
+#ifndef DEVIATION_H
+#define DEVIATION_H
+
+#include <QVector>
+#include "model.h"
+
+// Результат сравнения модели с эталоном
+struct DeviationResult
+{
+    QVector<float> distances;   // Расстояние от каждой вершины модели до поверхности эталона
+    double maxDistance = 0.0;   // Максимальное отклонение (односторонняя метрика Хаусдорфа)
+    double meanDistance = 0.0;  // Среднее отклонение
+    double rmsDistance = 0.0;   // Среднеквадратичное отклонение
+};
+
+class Deviation
+{
+public:
+    // Отклонение вершин модели от поверхности эталонной модели
+    static DeviationResult compute(const Model &model, const Model &reference);
+};
+
+#endif // DEVIATION_H
@@ -10,6 +10,8 @@
 #include <QLineEdit>
 #include <QPushButton>
 #include <QSplitter> // Добавляем для разделения окна
+#include <QCheckBox>
+#include <QElapsedTimer>
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent), modelViewer(new ModelViewer(this))
@@ -29,8 +31,10 @@ MainWindow::MainWindow(QWidget *parent)
     QMenu *fileMenu = menuBar()->addMenu("Файл");
     QAction *openAction = fileMenu->addAction("Открыть");
     QAction *saveTextAction = fileMenu->addAction("Сохранить текст");
+    QAction *exportModelAction = fileMenu->addAction("Экспорт модели");
     connect(openAction, &QAction::triggered, this, &MainWindow::openModel);
     connect(saveTextAction, &QAction::triggered, this, &MainWindow::saveText);
+    connect(exportModelAction, &QAction::triggered, this, &MainWindow::exportModel);
 
     QMenu *transformMenu = menuBar()->addMenu("Трансформации");
     QAction *rotateAction = transformMenu->addAction("Повернуть модель");
@@ -38,6 +42,16 @@ MainWindow::MainWindow(QWidget *parent)
     connect(rotateAction, &QAction::triggered, this, &MainWindow::rotateModel);
     connect(translateAction, &QAction::triggered, this, &MainWindow::translateModel);
 
+    QMenu *analysisMenu = menuBar()->addMenu("Анализ");
+    QAction *sliceAction = analysisMenu->addAction("Сечения модели");
+    QAction *exportSlicesAction = analysisMenu->addAction("Экспорт сечений");
+    QAction *orientedBoxAction = analysisMenu->addAction("Минимальный габаритный параллелепипед");
+    QAction *compareAction = analysisMenu->addAction("Сравнить с эталоном");
+    connect(sliceAction, &QAction::triggered, this, &MainWindow::sliceModel);
+    connect(exportSlicesAction, &QAction::triggered, this, &MainWindow::exportSlices);
+    connect(orientedBoxAction, &QAction::triggered, this, &MainWindow::computeOrientedBox);
+    connect(compareAction, &QAction::triggered, this, &MainWindow::compareWithReference);
+
     // Используем метод getViewer для подключения сигнала
     connect(modelViewer->getViewer(), &Viewer::vertexSelected, this, &MainWindow::updateVertexInfo);
 }
@@ -46,10 +60,11 @@ MainWindow::~MainWindow() {}
 
 void MainWindow::openModel()
 {
-    QString filePath = QFileDialog::getOpenFileName(this, "Открыть модель", "", "OBJ Files (*.obj)");
+    QString filePath = QFileDialog::getOpenFileName(this, "Открыть модель", "", "OBJ Files (*.obj);;Binary Model Files (*.vob)");
 
     if (!filePath.isEmpty()) {
         if (modelViewer->loadModel(filePath)) {
+            lastSlices.clear();
             // Сохраняем имя файла модели
             QFileInfo fileInfo(filePath);
             modelFileName = fileInfo.fileName(); // Получаем только имя файла (без пути)
@@ -118,6 +133,16 @@ void MainWindow::saveText()
     }
 }
 
+void MainWindow::exportModel()
+{
+    QString filePath = QFileDialog::getSaveFileName(this, "Экспорт модели", "", "OBJ Files (*.obj);;Binary Model Files (*.vob)");
+    if (!filePath.isEmpty()) {
+        if (!modelViewer->saveModel(filePath)) {
+            QMessageBox::warning(this, "Ошибка", "Не удалось сохранить модель.");
+        }
+    }
+}
+
 void MainWindow::rotateModel()
 {
     QDialog dialog(this);
@@ -139,6 +164,7 @@ void MainWindow::rotateModel()
         float angleZ = angleZInput.text().toFloat();
 
         modelViewer->rotateModel(angleX, angleY, angleZ);
+        lastSlices.clear();
         updateWindowTitle();
         dialog.close();
     });
@@ -168,6 +194,7 @@ void MainWindow::translateModel()
         float dz = dzInput.text().toFloat();
 
         modelViewer->translateModel(dx, dy, dz);
+        lastSlices.clear();
         updateWindowTitle();
         dialog.close();
     });
@@ -175,4 +202,140 @@ void MainWindow::translateModel()
     dialog.exec();
 }
 
+void MainWindow::sliceModel()
+{
+    QDialog dialog(this);
+    dialog.setWindowTitle("Сечения модели");
+
+    QFormLayout form(&dialog);
+    QLineEdit stepInput(&dialog);
+    QCheckBox showContoursInput(&dialog);
+    QPushButton applyButton("Применить", &dialog);
+    showContoursInput.setChecked(true);
+
+    form.addRow("Шаг по Z (м):", &stepInput);
+    form.addRow("Показать контуры:", &showContoursInput);
+    form.addRow(&applyButton);
+
+    connect(&applyButton, &QPushButton::clicked, [&]() {
+        float step = stepInput.text().toFloat();
+        if (step <= 0) {
+            QMessageBox::warning(&dialog, "Ошибка", "Шаг должен быть положительным.");
+            return;
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+        lastSlices = modelViewer->sliceModel(step);
+        qint64 elapsed = timer.elapsed();
+
+        // Сводка по сечениям: максимальная площадь и объем, набранный слоями
+        double maxArea = 0.0;
+        double layerVolume = 0.0;
+        for (const Slice &slice : lastSlices) {
+            maxArea = qMax(maxArea, slice.area);
+            layerVolume += slice.area * step;
+        }
+
+        QString sliceInfo = QString("Сечения:\n"
+                                    "Количество: %1\n"
+                                    "Максимальная площадь: %2 м²\n"
+                                    "Объем по слоям: %3 м³\n"
+                                    "Время расчета: %4 мс")
+                               .arg(lastSlices.size())
+                               .arg(maxArea, 0, 'f', 4)
+                               .arg(layerVolume, 0, 'f', 4)
+                               .arg(elapsed);
+        infoPanel->append(sliceInfo);
+
+        modelViewer->showSlices(showContoursInput.isChecked() ? lastSlices : QVector<Slice>());
+        dialog.close();
+    });
+
+    dialog.exec();
+}
 
+void MainWindow::exportSlices()
+{
+    if (lastSlices.isEmpty()) {
+        QMessageBox::warning(this, "Предупреждение", "Сначала выполните сечение модели.");
+        return;
+    }
+
+    QString filePath = QFileDialog::getSaveFileName(this, "Экспорт сечений", "", "CSV Files (*.csv)");
+    if (!filePath.isEmpty()) {
+        if (!Slicer::exportCsv(lastSlices, filePath)) {
+            QMessageBox::warning(this, "Ошибка", "Не удалось сохранить файл.");
+        }
+    }
+}
+
+void MainWindow::computeOrientedBox()
+{
+    QElapsedTimer timer;
+    timer.start();
+    int hullVertexCount = 0;
+    OrientedBox box = modelViewer->computeOrientedBox(&hullVertexCount);
+    qint64 elapsed = timer.elapsed();
+
+    if (box.getVolume() <= 0) {
+        QMessageBox::warning(this, "Ошибка", "Не удалось построить выпуклую оболочку модели.");
+        return;
+    }
+
+    QVector3D size = box.getSize();
+    QVector3D dimensions = modelViewer->getModelDimensions();
+    double axisAlignedVolume = double(dimensions.x()) * dimensions.y() * dimensions.z();
+    QString boxInfo = QString("Минимальный габаритный параллелепипед:\n"
+                              "Вершин выпуклой оболочки: %1\n"
+                              "Размеры: %2x%3x%4 м\n"
+                              "Объем: %5 м³ (по осям координат: %6 м³)\n"
+                              "Время расчета: %7 мс")
+                         .arg(hullVertexCount)
+                         .arg(size.x(), 0, 'f', 2)
+                         .arg(size.y(), 0, 'f', 2)
+                         .arg(size.z(), 0, 'f', 2)
+                         .arg(box.getVolume(), 0, 'f', 4)
+                         .arg(axisAlignedVolume, 0, 'f', 4)
+                         .arg(elapsed);
+    infoPanel->append(boxInfo);
+
+    if (QMessageBox::question(this, "Выравнивание", "Повернуть модель по осям параллелепипеда?") == QMessageBox::Yes) {
+        QVector3D angles = box.getAlignmentAngles();
+        modelViewer->rotateModel(angles.x(), angles.y(), angles.z());
+        lastSlices.clear();
+        updateWindowTitle();
+        infoPanel->append(boxInfo);
+    }
+}
+
+void MainWindow::compareWithReference()
+{
+    QString filePath = QFileDialog::getOpenFileName(this, "Открыть эталонную модель", "", "OBJ Files (*.obj);;Binary Model Files (*.vob)");
+    if (filePath.isEmpty() || !modelViewer->loadReferenceModel(filePath)) {
+        return;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    DeviationResult result = modelViewer->compareWithReference();
+    qint64 elapsed = timer.elapsed();
+
+    if (result.distances.isEmpty()) {
+        QMessageBox::warning(this, "Ошибка", "Модель или эталон не содержат граней для сравнения.");
+        return;
+    }
+
+    // Отклонения выводятся в миллиметрах, как в исходных файлах
+    QString deviationInfo = QString("Сравнение с эталоном %1:\n"
+                                    "Максимальное отклонение: %2 мм\n"
+                                    "Среднее отклонение: %3 мм\n"
+                                    "СКО: %4 мм\n"
+                                    "Время расчета: %5 мс")
+                               .arg(QFileInfo(filePath).fileName())
+                               .arg(result.maxDistance * 1000.0, 0, 'f', 3)
+                               .arg(result.meanDistance * 1000.0, 0, 'f', 3)
+                               .arg(result.rmsDistance * 1000.0, 0, 'f', 3)
+                               .arg(elapsed);
+    infoPanel->append(deviationInfo);
+}
@@ -16,8 +16,13 @@ public:
 private slots:
     void openModel();
     void saveText();
+    void exportModel();
     void rotateModel();
     void translateModel();
+    void sliceModel();
+    void exportSlices();
+    void computeOrientedBox();
+    void compareWithReference();
     void updateWindowTitle();
     void updateVertexInfo(int index, const QVector3D &vertex); // Новый слот для обновления информации о вершине
 
@@ -25,6 +30,7 @@ private:
     ModelViewer *modelViewer;
     QTextEdit *infoPanel; // Добавляем текстовое поле для информации
     QString modelFileName; // Переменная для хранения имени файла модели
+    QVector<Slice> lastSlices; // Результаты последнего сечения модели
 };
 
 #endif // MAINWINDOW_H
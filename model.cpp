@@ -1,7 +1,11 @@
 #include "model.h"
+#include "modelexporter.h"
 #include <QFile>
 #include <QTextStream>
+#include <QtEndian>
 #include <cmath>
+#include <cstring>
+#include <limits>
 #include <QSet>
 
 // Конструктор класса Model
@@ -9,6 +13,9 @@ Model::Model() {}
 
 // Метод для загрузки модели из файла
 bool Model::load(const QString &filePath) {
+    if (filePath.endsWith(".vob", Qt::CaseInsensitive))
+        return loadBinary(filePath);
+
     QFile file(filePath);
     if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
         return false;
@@ -23,9 +30,10 @@ bool Model::load(const QString &filePath) {
         if (parts.isEmpty()) continue;
 
         if (parts[0] == "v") {
-            float x = parts[1].toFloat() / 1000.0f;
-            float y = parts[2].toFloat() / 1000.0f;
-            float z = parts[3].toFloat() / 1000.0f;
+            // Деление в двойной точности, чтобы экспортированные координаты читались без потерь
+            float x = float(parts[1].toDouble() / 1000.0);
+            float y = float(parts[2].toDouble() / 1000.0);
+            float z = float(parts[3].toDouble() / 1000.0);
             vertices.append(QVector3D(x, y, z));
         }
         else if (parts[0] == "f") {
@@ -41,6 +49,67 @@ bool Model::load(const QString &filePath) {
     return true;
 }
 
+// Метод для загрузки модели из двоичного файла, сохраненного ModelExporter::saveBinary
+bool Model::loadBinary(const QString &filePath) {
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+
+    char header[32];
+    if (file.read(header, sizeof(header)) != qint64(sizeof(header))
+        || memcmp(header, ModelExporter::binarySignature, 4) != 0
+        || qFromLittleEndian<quint32>(header + 4) != ModelExporter::binaryVersion)
+        return false;
+
+    quint64 vertexCount = qFromLittleEndian<quint64>(header + 8);
+    quint64 faceCount = qFromLittleEndian<quint64>(header + 16);
+    quint64 indexCount = qFromLittleEndian<quint64>(header + 24);
+    // Количества из заголовка сначала ограничиваются размером файла,
+    // чтобы дальнейшая арифметика не переполнялась
+    quint64 maxCount = quint64(file.size()) / sizeof(quint32);
+    if (vertexCount > maxCount || faceCount > maxCount || indexCount > maxCount
+        || vertexCount > quint64(std::numeric_limits<int>::max()) || faceCount > quint64(std::numeric_limits<int>::max())
+        || faceCount > indexCount
+        || quint64(file.size()) != sizeof(header) + vertexCount * 3 * sizeof(float) + (faceCount + indexCount) * sizeof(quint32))
+        return false;
+
+    QVector<QVector3D> newVertices(vertexCount);
+    QVector<quint32> faceSizes(faceCount);
+    QVector<quint32> indices(indexCount);
+    qint64 vertexBytes = vertexCount * 3 * sizeof(float);
+    if (file.read(reinterpret_cast<char *>(newVertices.data()), vertexBytes) != vertexBytes
+        || file.read(reinterpret_cast<char *>(faceSizes.data()), faceCount * sizeof(quint32)) != qint64(faceCount * sizeof(quint32))
+        || file.read(reinterpret_cast<char *>(indices.data()), indexCount * sizeof(quint32)) != qint64(indexCount * sizeof(quint32)))
+        return false;
+    file.close();
+
+    qFromLittleEndian<quint32>(newVertices.constData(), vertexCount * 3, newVertices.data());
+    qFromLittleEndian<quint32>(faceSizes.constData(), faceCount, faceSizes.data());
+    qFromLittleEndian<quint32>(indices.constData(), indexCount, indices.data());
+
+    // Собираем грани, проверяя индексы
+    QVector<QVector<int>> newFaces(faceCount);
+    quint64 position = 0;
+    for (quint64 i = 0; i < faceCount; ++i) {
+        if (faceSizes[i] > indexCount - position)
+            return false;
+        QVector<int> &face = newFaces[i];
+        face.resize(faceSizes[i]);
+        for (quint32 k = 0; k < faceSizes[i]; ++k) {
+            quint32 index = indices[position++];
+            if (index >= vertexCount)
+                return false;
+            face[k] = index;
+        }
+    }
+    if (position != indexCount)
+        return false;
+
+    vertices = newVertices;
+    faces = newFaces;
+    return true;
+}
+
 // Метод для вычисления объема модели
 double Model::calculateVolume() const {
     double volume = 0.0;
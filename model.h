@@ -12,6 +12,7 @@ class Model
 public:
     Model();
     bool load(const QString &filePath);
+    bool loadBinary(const QString &filePath);
     double calculateVolume() const;
     double calculateProjectionArea() const;
     QVector3D getModelDimensions() const;
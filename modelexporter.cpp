@@ -0,0 +1,210 @@
+#include "modelexporter.h"
+#include <QFile>
+#include <QThread>
+#include <QtEndian>
+#include <QtConcurrent/QtConcurrent>
+#include <charconv>
+#include <cstring>
+
+const char ModelExporter::binarySignature[4] = { 'V', 'O', 'B', 'J' };
+
+namespace {
+
+static_assert(sizeof(QVector3D) == 3 * sizeof(float), "QVector3D must be three packed floats");
+
+// Количество строк OBJ (или записей двоичного файла) в одном блоке
+const int itemsPerChunk = 16384;
+
+// Ограничение памяти под одну пачку блоков; одновременно существуют две пачки
+const qint64 maxBatchBytes = 64 * 1024 * 1024;
+
+// Блок файла: диапазон элементов и сформированные для них байты
+struct Chunk
+{
+    int begin;
+    int end;
+    QByteArray data;
+};
+
+// Запись раздела файла блоками. Пачка блоков форматируется параллельно, пока
+// предыдущая пачка записывается в файл по порядку крупными порциями. Размер пачки
+// ограничен по памяти исходя из оценки bytesPerItem байт на элемент.
+template <typename Formatter>
+bool writeChunked(QFile &file, int count, int bytesPerItem, Formatter format) {
+    if (count <= 0) return true;
+
+    qint64 maxChunks = qMax(1, QThread::idealThreadCount()) * 2;
+    int chunksPerBatch = int(qBound(qint64(1), maxBatchBytes / (qint64(itemsPerChunk) * bytesPerItem), maxChunks));
+    int itemsPerBatch = itemsPerChunk * chunksPerBatch;
+
+    QVector<Chunk> batches[2];
+    QFuture<void> formatting[2];
+    auto startBatch = [&](int slot, int batchBegin) {
+        QVector<Chunk> &chunks = batches[slot];
+        chunks.clear();
+        int batchEnd = batchBegin + qMin(itemsPerBatch, count - batchBegin);
+        for (int begin = batchBegin; begin < batchEnd; begin += itemsPerChunk) {
+            chunks.append({ begin, begin + qMin(itemsPerChunk, batchEnd - begin), QByteArray() });
+        }
+        formatting[slot] = QtConcurrent::map(chunks, [&format](Chunk &chunk) {
+            format(chunk);
+        });
+    };
+
+    bool ok = true;
+    int slot = 0;
+    int batchBegin = 0;
+    startBatch(slot, batchBegin);
+    while (ok) {
+        formatting[slot].waitForFinished();
+        int nextBegin = batchBegin + qMin(itemsPerBatch, count - batchBegin);
+        if (nextBegin < count)
+            startBatch(slot ^ 1, nextBegin);
+
+        for (const Chunk &chunk : batches[slot]) {
+            if (file.write(chunk.data) != chunk.data.size()) {
+                ok = false;
+                break;
+            }
+        }
+        if (nextBegin >= count) break;
+        batchBegin = nextBegin;
+        slot ^= 1;
+    }
+
+    // При ошибке записи следующая пачка может еще форматироваться
+    formatting[0].waitForFinished();
+    formatting[1].waitForFinished();
+    return ok;
+}
+
+// Координата в единицах исходного файла. Загрузчик читает число в двойной точности
+// и делит на 1000, поэтому точное произведение value * 1000 всегда читается без потерь.
+// Чаще всего для этого хватает более короткой записи произведения в одинарной точности.
+char *writeCoordinate(char *out, float value) {
+    char *end = std::to_chars(out, out + 32, value * 1000.0f).ptr;
+    double parsed = 0.0;
+    std::from_chars(out, end, parsed);
+    if (float(parsed / 1000.0) == value) return end;
+    return std::to_chars(out, out + 32, double(value) * 1000.0).ptr;
+}
+
+char *writeInt(char *out, int value) {
+    return std::to_chars(out, out + 16, value).ptr;
+}
+
+// Блок строк "v x y z"
+void formatVertices(Chunk &chunk, const QVector<QVector3D> &vertices) {
+    chunk.data.resize((chunk.end - chunk.begin) * 96);
+    char *begin = chunk.data.data();
+    char *out = begin;
+    for (int i = chunk.begin; i < chunk.end; ++i) {
+        const QVector3D &vertex = vertices[i];
+        *out++ = 'v';
+        *out++ = ' ';
+        out = writeCoordinate(out, vertex.x());
+        *out++ = ' ';
+        out = writeCoordinate(out, vertex.y());
+        *out++ = ' ';
+        out = writeCoordinate(out, vertex.z());
+        *out++ = '\n';
+    }
+    chunk.data.resize(out - begin);
+}
+
+// Блок строк "f a b c ..." (индексы в OBJ начинаются с единицы)
+void formatFaces(Chunk &chunk, const QVector<QVector<int>> &faces) {
+    qsizetype capacity = 0;
+    for (int i = chunk.begin; i < chunk.end; ++i) {
+        capacity += 2 + faces[i].size() * 12;
+    }
+    chunk.data.resize(capacity);
+    char *begin = chunk.data.data();
+    char *out = begin;
+    for (int i = chunk.begin; i < chunk.end; ++i) {
+        *out++ = 'f';
+        for (int index : faces[i]) {
+            *out++ = ' ';
+            out = writeInt(out, index + 1);
+        }
+        *out++ = '\n';
+    }
+    chunk.data.resize(out - begin);
+}
+
+} // namespace
+
+// Метод для сохранения модели в формате OBJ
+bool ModelExporter::saveObj(const Model &model, const QString &filePath) {
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return false;
+
+    const QVector<QVector3D> &vertices = model.getVertices();
+    const QVector<QVector<int>> &faces = model.getFaces();
+
+    bool ok = file.write("# ViewerObj\n") > 0
+           && writeChunked(file, vertices.size(), 96, [&vertices](Chunk &chunk) {
+                  formatVertices(chunk, vertices);
+              })
+           && writeChunked(file, faces.size(), 48, [&faces](Chunk &chunk) {
+                  formatFaces(chunk, faces);
+              });
+
+    file.close();
+    return ok && file.error() == QFileDevice::NoError;
+}
+
+// Метод для сохранения модели в двоичном формате
+bool ModelExporter::saveBinary(const Model &model, const QString &filePath) {
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return false;
+
+    const QVector<QVector3D> &vertices = model.getVertices();
+    const QVector<QVector<int>> &faces = model.getFaces();
+
+    quint64 indexCount = 0;
+    for (const QVector<int> &face : faces) {
+        indexCount += face.size();
+    }
+
+    // Заголовок
+    char header[32];
+    std::memcpy(header, binarySignature, 4);
+    qToLittleEndian<quint32>(binaryVersion, header + 4);
+    qToLittleEndian<quint64>(vertices.size(), header + 8);
+    qToLittleEndian<quint64>(faces.size(), header + 16);
+    qToLittleEndian<quint64>(indexCount, header + 24);
+
+    bool ok = file.write(header, sizeof(header)) == qint64(sizeof(header))
+           && writeChunked(file, vertices.size(), 3 * sizeof(float), [&vertices](Chunk &chunk) {
+                  int count = (chunk.end - chunk.begin) * 3;
+                  chunk.data.resize(count * sizeof(quint32));
+                  qToLittleEndian<quint32>(&vertices[chunk.begin], count, chunk.data.data());
+              })
+           && writeChunked(file, faces.size(), sizeof(quint32), [&faces](Chunk &chunk) {
+                  chunk.data.resize((chunk.end - chunk.begin) * sizeof(quint32));
+                  char *out = chunk.data.data();
+                  for (int i = chunk.begin; i < chunk.end; ++i, out += sizeof(quint32)) {
+                      qToLittleEndian<quint32>(faces[i].size(), out);
+                  }
+              })
+           && writeChunked(file, faces.size(), 3 * sizeof(quint32), [&faces](Chunk &chunk) {
+                  qsizetype count = 0;
+                  for (int i = chunk.begin; i < chunk.end; ++i) {
+                      count += faces[i].size();
+                  }
+                  chunk.data.resize(count * sizeof(quint32));
+                  char *out = chunk.data.data();
+                  for (int i = chunk.begin; i < chunk.end; ++i) {
+                      for (int index : faces[i]) {
+                          qToLittleEndian<quint32>(index, out);
+                          out += sizeof(quint32);
+                      }
+                  }
+              });
+
+    file.close();
+    return ok && file.error() == QFileDevice::NoError;
+}
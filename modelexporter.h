@@ -0,0 +1,26 @@
+#ifndef MODELEXPORTER_H
+#define MODELEXPORTER_H
+
+#include <QString>
+#include "model.h"
+
+// Двоичный формат модели (*.vob), все числа в порядке байтов little-endian:
+//   char[4]  сигнатура "VOBJ"
+//   quint32  версия формата
+//   quint64  количество вершин, граней и индексов
+//   float[3] координаты каждой вершины (в метрах, как в Model)
+//   quint32  количество вершин каждой грани
+//   quint32  индексы вершин всех граней подряд (с нуля)
+class ModelExporter
+{
+public:
+    // Сохранение в OBJ с обратным пересчетом координат в единицы исходного файла
+    static bool saveObj(const Model &model, const QString &filePath);
+    // Сохранение в двоичный формат без потери точности
+    static bool saveBinary(const Model &model, const QString &filePath);
+
+    static const char binarySignature[4];
+    static const quint32 binaryVersion = 1;
+};
+
+#endif // MODELEXPORTER_H
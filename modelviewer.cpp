@@ -1,10 +1,11 @@
 #include "modelviewer.h"
+#include "modelexporter.h"
 #include <QVBoxLayout>
 #include <QFileDialog>
 #include <QMessageBox>
 
 ModelViewer::ModelViewer(QWidget *parent)
-    : QWidget(parent), model(new Model()), viewer(new Viewer(this))
+    : QWidget(parent), model(new Model()), referenceModel(new Model()), viewer(new Viewer(this))
 {
     QVBoxLayout *layout = new QVBoxLayout(this);
     layout->addWidget(viewer);
@@ -20,6 +21,8 @@ bool ModelViewer::loadModel(const QString &filePath)
 {
     if (model->load(filePath)) {
         viewer->setModel(model);
+        viewer->setSlices(QVector<Slice>());
+        viewer->setDeviations(QVector<float>(), 0);
 
         QVector3D dimensions = model->getModelDimensions();
         float maxDimension = qMax(dimensions.x(), qMax(dimensions.y(), dimensions.z()));
@@ -35,6 +38,26 @@ bool ModelViewer::loadModel(const QString &filePath)
     }
 }
 
+// Метод для сохранения модели в файл, формат выбирается по расширению
+bool ModelViewer::saveModel(const QString &filePath) const
+{
+    if (filePath.endsWith(".vob", Qt::CaseInsensitive)) {
+        return ModelExporter::saveBinary(*model, filePath);
+    }
+    return ModelExporter::saveObj(*model, filePath);
+}
+
+// Метод для загрузки эталонной модели, с которой сравнивается текущая
+bool ModelViewer::loadReferenceModel(const QString &filePath)
+{
+    if (referenceModel->load(filePath)) {
+        return true;
+    } else {
+        QMessageBox::critical(this, "Ошибка", "Не удалось загрузить эталонную модель.");
+        return false;
+    }
+}
+
 // Метод для получения размеров модели
 QVector3D ModelViewer::getModelDimensions() const {
     return model->getModelDimensions();
@@ -50,16 +73,44 @@ double ModelViewer::calculateProjectionArea() const {
     return model->calculateProjectionArea();
 }
 
+// Метод для вычисления минимального ориентированного параллелепипеда по выпуклой оболочке модели
+OrientedBox ModelViewer::computeOrientedBox(int *hullVertexCount) const {
+    ConvexHull hull = ConvexHull::compute(model->getVertices());
+    if (hullVertexCount) {
+        *hullVertexCount = hull.getVertices().size();
+    }
+    return OrientedBox::compute(hull);
+}
+
+// Метод для сравнения модели с эталоном; отклонения вершин отображаются цветовой картой
+DeviationResult ModelViewer::compareWithReference() {
+    DeviationResult result = Deviation::compute(*model, *referenceModel);
+    viewer->setDeviations(result.distances, result.maxDistance);
+    return result;
+}
+
 // Метод для вращения модели на заданные углы по осям X, Y и Z
 void ModelViewer::rotateModel(float angleX, float angleY, float angleZ) {
     model->rotateX(angleX);
     model->rotateY(angleY);
     model->rotateZ(angleZ);
-    viewer->update();
+    viewer->setSlices(QVector<Slice>()); // Сечения и отклонения больше не соответствуют модели
+    viewer->setDeviations(QVector<float>(), 0);
 }
 
 // Метод для перемещения модели на заданные расстояния по осям X, Y и Z
 void ModelViewer::translateModel(float dx, float dy, float dz) {
     model->translate(dx, dy, dz);
-    viewer->update();
+    viewer->setSlices(QVector<Slice>()); // Сечения и отклонения больше не соответствуют модели
+    viewer->setDeviations(QVector<float>(), 0);
+}
+
+// Метод для сечения модели горизонтальными плоскостями с заданным шагом по Z
+QVector<Slice> ModelViewer::sliceModel(float step) const {
+    return Slicer::slice(*model, Slicer::uniformHeights(*model, step));
+}
+
+// Метод для отображения контуров сечений поверх модели
+void ModelViewer::showSlices(const QVector<Slice> &slices) {
+    viewer->setSlices(slices);
 }
@@ -4,6 +4,9 @@
 #include <QWidget>
 #include "model.h"
 #include "viewer.h"
+#include "slicer.h"
+#include "orientedbox.h"
+#include "deviation.h"
 
 class ModelViewer : public QWidget
 {
@@ -12,18 +15,26 @@ class ModelViewer : public QWidget
 public:
     ModelViewer(QWidget *parent = nullptr);
     bool loadModel(const QString &filePath);
+    bool saveModel(const QString &filePath) const;
+    bool loadReferenceModel(const QString &filePath);
 
     QVector3D getModelDimensions() const;
     double calculateVolume() const;
     double calculateProjectionArea() const;
+    OrientedBox computeOrientedBox(int *hullVertexCount = nullptr) const;
+    DeviationResult compareWithReference();
 
     void rotateModel(float angleX, float angleY, float angleZ);
     void translateModel(float dx, float dy, float dz);
 
+    QVector<Slice> sliceModel(float step) const;
+    void showSlices(const QVector<Slice> &slices);
+
     Viewer* getViewer() const; // Новый метод для получения указателя на Viewer
 
 private:
     Model *model;
+    Model *referenceModel; // Эталонная модель для анализа отклонений
     Viewer *viewer;
 };
 
@@ -0,0 +1,356 @@
+#include "orientedbox.h"
+#include <QHash>
+#include <QPointF>
+#include <QSet>
+#include <QtConcurrent/QtConcurrent>
+#include <QtMath>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+// Ограничения на число направлений граней оболочки, проверяемых в качестве оси параллелепипеда.
+// Каждое направление требует проекции всех вершин оболочки, поэтому для больших оболочек
+// число направлений уменьшается так, чтобы общее число проекций не превышало бюджет.
+const int minCandidates = 32;
+const int maxCandidates = 1024;
+const qint64 projectionBudget = 20000000;
+
+// Число лучших кандидатов, уточняемых локальным поиском, и шаги поворота при поиске
+const int refineCount = 4;
+const float refineStartStep = 2.0f;
+const float refineMinStep = 0.01f;
+
+// Группа граней оболочки с близкими нормалями
+struct FaceGroup
+{
+    QVector3D normal;         // Нормаль наибольшей грани группы
+    double area = 0.0;        // Суммарная площадь граней
+    double largestArea = 0.0; // Площадь наибольшей грани
+};
+
+// Ребро оболочки
+struct Edge
+{
+    QVector3D direction;
+    double length;
+};
+
+// Кандидат в ось параллелепипеда и лучший параллелепипед для нее
+struct Candidate
+{
+    QVector3D direction;
+    double volume = std::numeric_limits<double>::infinity();
+    QVector3D center;
+    QVector3D axes[3];
+    QVector3D size;
+};
+
+// Ключ направления для объединения близких направлений. Направления n и -n задают
+// один и тот же параллелепипед, поэтому направление приводится к одной полусфере.
+quint64 directionKey(QVector3D &direction) {
+    if (direction.x() < 0 || (direction.x() == 0 && (direction.y() < 0 || (direction.y() == 0 && direction.z() < 0)))) {
+        direction = -direction;
+    }
+    return (quint64(quint16(qRound(direction.x() * 512))) << 32)
+         | (quint64(quint16(qRound(direction.y() * 512))) << 16)
+         | quint64(quint16(qRound(direction.z() * 512)));
+}
+
+double cross2D(const QPointF &o, const QPointF &a, const QPointF &b) {
+    return (a.x() - o.x()) * (b.y() - o.y()) - (a.y() - o.y()) * (b.x() - o.x());
+}
+
+// Двумерная выпуклая оболочка (монотонная цепочка Эндрю), обход против часовой стрелки
+QVector<QPointF> convexHull2D(QVector<QPointF> points) {
+    std::sort(points.begin(), points.end(), [](const QPointF &a, const QPointF &b) {
+        return a.x() < b.x() || (a.x() == b.x() && a.y() < b.y());
+    });
+
+    QVector<QPointF> hull(2 * points.size());
+    int k = 0;
+    for (int i = 0; i < points.size(); ++i) {
+        while (k >= 2 && cross2D(hull[k - 2], hull[k - 1], points[i]) <= 0) --k;
+        hull[k++] = points[i];
+    }
+    for (int i = points.size() - 2, lower = k + 1; i >= 0; --i) {
+        while (k >= lower && cross2D(hull[k - 2], hull[k - 1], points[i]) <= 0) --k;
+        hull[k++] = points[i];
+    }
+    hull.resize(qMax(0, k - 1));
+    return hull;
+}
+
+double dot2D(const QPointF &a, const QPointF &b) {
+    return a.x() * b.x() + a.y() * b.y();
+}
+
+// Лучший параллелепипед, у которого одна из осей совпадает с направлением кандидата.
+// Точки оболочки проецируются на перпендикулярную плоскость, и для проекции методом
+// вращающихся калиперов ищется прямоугольник минимальной площади.
+void fitCandidate(Candidate &candidate, const QVector<QVector3D> &vertices) {
+    QVector3D n = candidate.direction;
+    QVector3D u = QVector3D::crossProduct(n, std::abs(n.x()) < 0.9f ? QVector3D(1, 0, 0) : QVector3D(0, 1, 0)).normalized();
+    QVector3D v = QVector3D::crossProduct(n, u);
+
+    QVector<QPointF> projected;
+    projected.reserve(vertices.size());
+    double minH = std::numeric_limits<double>::max();
+    double maxH = std::numeric_limits<double>::lowest();
+    for (const QVector3D &vertex : vertices) {
+        projected.append(QPointF(QVector3D::dotProduct(vertex, u), QVector3D::dotProduct(vertex, v)));
+        double h = QVector3D::dotProduct(vertex, n);
+        minH = qMin(minH, h);
+        maxH = qMax(maxH, h);
+    }
+
+    QVector<QPointF> hull = convexHull2D(projected);
+    int m = hull.size();
+    if (m < 3) return;
+
+    // Для каждого ребра многоугольника указатели на крайние точки
+    // (по направлению ребра, по нормали и против направления) только продвигаются вперед
+    int right = 0, top = 0, left = 0;
+    for (int i = 0; i < m; ++i) {
+        QPointF edge = hull[(i + 1) % m] - hull[i];
+        double length = std::sqrt(dot2D(edge, edge));
+        if (length <= 0) continue;
+        QPointF e = edge / length;
+        QPointF normal(-e.y(), e.x());
+
+        if (i == 0) {
+            for (int j = 1; j < m; ++j) {
+                if (dot2D(hull[j], e) > dot2D(hull[right], e)) right = j;
+                if (dot2D(hull[j], normal) > dot2D(hull[top], normal)) top = j;
+                if (dot2D(hull[j], e) < dot2D(hull[left], e)) left = j;
+            }
+        } else {
+            while (dot2D(hull[(right + 1) % m], e) > dot2D(hull[right], e)) right = (right + 1) % m;
+            while (dot2D(hull[(top + 1) % m], normal) > dot2D(hull[top], normal)) top = (top + 1) % m;
+            while (dot2D(hull[(left + 1) % m], e) < dot2D(hull[left], e)) left = (left + 1) % m;
+        }
+
+        double minE = dot2D(hull[left], e);
+        double maxE = dot2D(hull[right], e);
+        double minN = dot2D(hull[i], normal);
+        double maxN = dot2D(hull[top], normal);
+        double volume = (maxE - minE) * (maxN - minN) * (maxH - minH);
+        if (volume < candidate.volume) {
+            QVector3D axisE = u * e.x() + v * e.y();
+            QVector3D axisN = u * normal.x() + v * normal.y();
+            candidate.volume = volume;
+            candidate.axes[0] = axisE;
+            candidate.axes[1] = axisN;
+            candidate.axes[2] = n;
+            candidate.size = QVector3D(maxE - minE, maxN - minN, maxH - minH);
+            candidate.center = axisE * ((minE + maxE) / 2) + axisN * ((minN + maxN) / 2) + n * ((minH + maxH) / 2);
+        }
+    }
+}
+
+// Локальный поиск вокруг найденного параллелепипеда: направление кандидата
+// наклоняется к двум другим осям параллелепипеда, пока объем уменьшается, а шаг
+// поворота уменьшается вдвое, когда улучшить объем не удается. Так находятся
+// параллелепипеды, которые касаются оболочки только ребрами соседних граней.
+void refineCandidate(Candidate &candidate, const QVector<QVector3D> &vertices, int maxEvaluations) {
+    float step = refineStartStep;
+    int evaluations = 0;
+    while (step >= refineMinStep && evaluations < maxEvaluations) {
+        float radians = qDegreesToRadians(step);
+        QVector3D tilts[4] = { candidate.axes[0], -candidate.axes[0], candidate.axes[1], -candidate.axes[1] };
+        bool improved = false;
+        for (const QVector3D &tilt : tilts) {
+            Candidate neighbor;
+            neighbor.direction = (candidate.direction * std::cos(radians) + tilt * std::sin(radians)).normalized();
+            fitCandidate(neighbor, vertices);
+            ++evaluations;
+            if (neighbor.volume < candidate.volume) {
+                candidate = neighbor;
+                improved = true;
+                break;
+            }
+        }
+        if (!improved) step /= 2;
+    }
+}
+
+} // namespace
+
+// Конструктор класса OrientedBox
+OrientedBox::OrientedBox()
+    : axes{ QVector3D(1, 0, 0), QVector3D(0, 1, 0), QVector3D(0, 0, 1) }
+{
+}
+
+// Метод для вычисления параллелепипеда минимального объема. В качестве одной из осей
+// перебираются направления нормалей граней оболочки (параллелепипеды с гранью, прилегающей
+// к грани оболочки), векторные произведения пар ребер оболочки (противоположные грани
+// параллелепипеда проходят через ребра) и оси координат, поэтому результат никогда не хуже
+// габаритов по осям. Для больших оболочек проверяются направления наибольших граней и самых
+// длинных ребер. Лучшие кандидаты затем уточняются локальным поиском, поэтому случаи, когда
+// параллелепипед касается оболочки только ребрами соседних граней, находятся приближенно.
+// Кандидаты обрабатываются параллельно.
+OrientedBox OrientedBox::compute(const ConvexHull &hull) {
+    OrientedBox box;
+    if (hull.isEmpty()) return box;
+
+    const QVector<QVector3D> &vertices = hull.getVertices();
+    int candidateCount = int(qBound(qint64(minCandidates), projectionBudget / vertices.size(), qint64(maxCandidates)));
+    QSet<quint64> usedDirections;
+    QVector<Candidate> candidates;
+
+    // Группируем грани с близкими нормалями и собираем ребра оболочки
+    QHash<quint64, int> groupIndex;
+    QVector<FaceGroup> groups;
+    QVector<Edge> edges;
+    for (const QVector<int> &face : hull.getFaces()) {
+        for (int k = 0; k < 3; ++k) {
+            // Каждое ребро замкнутой оболочки входит в две грани в разных направлениях
+            int i = face[k];
+            int j = face[(k + 1) % 3];
+            if (i < j) {
+                QVector3D direction = vertices[j] - vertices[i];
+                double length = direction.length();
+                if (length > 0) edges.append({ direction / length, length });
+            }
+        }
+
+        QVector3D normal = QVector3D::crossProduct(vertices[face[1]] - vertices[face[0]], vertices[face[2]] - vertices[face[0]]);
+        double area = normal.length() / 2.0;
+        if (area <= 0) continue;
+        normal.normalize();
+
+        quint64 key = directionKey(normal);
+        int index = groupIndex.value(key, -1);
+        if (index < 0) {
+            index = groups.size();
+            groupIndex.insert(key, index);
+            groups.append(FaceGroup());
+        }
+        FaceGroup &group = groups[index];
+        group.area += area;
+        if (area > group.largestArea) {
+            group.largestArea = area;
+            group.normal = normal;
+        }
+    }
+
+    // Нормали граней: группы с наибольшей суммарной площадью
+    std::sort(groups.begin(), groups.end(), [](const FaceGroup &a, const FaceGroup &b) {
+        return a.area > b.area;
+    });
+    if (groups.size() > candidateCount / 2) groups.resize(candidateCount / 2);
+    for (const FaceGroup &group : groups) {
+        QVector3D direction = group.normal;
+        usedDirections.insert(directionKey(direction));
+        Candidate candidate;
+        candidate.direction = direction;
+        candidates.append(candidate);
+    }
+
+    // Пары самых длинных ребер с разными направлениями: вместе с нормалями граней
+    // число кандидатов не превышает candidateCount
+    std::sort(edges.begin(), edges.end(), [](const Edge &a, const Edge &b) {
+        return a.length > b.length;
+    });
+    int pairLimit = candidateCount - int(groups.size());
+    int edgeLimit = 1;
+    while ((edgeLimit + 1) * edgeLimit / 2 <= pairLimit) ++edgeLimit;
+    QSet<quint64> edgeDirections;
+    QVector<QVector3D> longestEdges;
+    for (const Edge &edge : edges) {
+        if (longestEdges.size() >= edgeLimit) break;
+        QVector3D direction = edge.direction;
+        quint64 key = directionKey(direction);
+        if (edgeDirections.contains(key)) continue;
+        edgeDirections.insert(key);
+        longestEdges.append(direction);
+    }
+    for (int i = 0; i < longestEdges.size(); ++i) {
+        for (int j = i + 1; j < longestEdges.size(); ++j) {
+            QVector3D direction = QVector3D::crossProduct(longestEdges[i], longestEdges[j]);
+            if (direction.length() < 1e-3f) continue; // Почти параллельные ребра
+            direction.normalize();
+            quint64 key = directionKey(direction);
+            if (usedDirections.contains(key)) continue;
+            usedDirections.insert(key);
+            Candidate candidate;
+            candidate.direction = direction;
+            candidates.append(candidate);
+        }
+    }
+
+    for (int axis = 0; axis < 3; ++axis) {
+        Candidate candidate;
+        candidate.direction[axis] = 1.0f;
+        candidates.append(candidate);
+    }
+
+    QtConcurrent::blockingMap(candidates, [&vertices](Candidate &candidate) {
+        fitCandidate(candidate, vertices);
+    });
+
+    // Уточняем лучших кандидатов
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate &a, const Candidate &b) {
+        return a.volume < b.volume;
+    });
+    if (candidates.size() > refineCount) candidates.resize(refineCount);
+    int maxEvaluations = int(qBound(qint64(16), projectionBudget / vertices.size() / refineCount / 2, qint64(256)));
+    QtConcurrent::blockingMap(candidates, [&vertices, maxEvaluations](Candidate &candidate) {
+        if (!std::isinf(candidate.volume)) refineCandidate(candidate, vertices, maxEvaluations);
+    });
+
+    const Candidate &best = *std::min_element(candidates.begin(), candidates.end(), [](const Candidate &a, const Candidate &b) {
+        return a.volume < b.volume;
+    });
+    if (std::isinf(best.volume)) return box;
+
+    // Упорядочиваем оси по убыванию размера и делаем тройку правой
+    int order[3] = { 0, 1, 2 };
+    std::sort(order, order + 3, [&best](int a, int b) {
+        return best.size[a] > best.size[b];
+    });
+    box.center = best.center;
+    for (int i = 0; i < 3; ++i) {
+        box.axes[i] = best.axes[order[i]];
+        box.size[i] = best.size[order[i]];
+    }
+    box.axes[2] = QVector3D::crossProduct(box.axes[0], box.axes[1]);
+    return box;
+}
+
+// Метод для получения центра параллелепипеда
+QVector3D OrientedBox::getCenter() const {
+    return center;
+}
+
+// Метод для получения оси параллелепипеда
+QVector3D OrientedBox::getAxis(int index) const {
+    return axes[index];
+}
+
+// Метод для получения размеров параллелепипеда вдоль его осей
+QVector3D OrientedBox::getSize() const {
+    return size;
+}
+
+// Метод для вычисления объема параллелепипеда
+double OrientedBox::getVolume() const {
+    return double(size.x()) * size.y() * size.z();
+}
+
+// Метод для получения углов поворота, выравнивающих модель по параллелепипеду.
+// Матрица поворота R = Rz * Ry * Rx имеет строками оси параллелепипеда.
+QVector3D OrientedBox::getAlignmentAngles() const {
+    double beta = std::asin(qBound(-1.0, -double(axes[2].x()), 1.0));
+    double alpha, gamma;
+    if (std::cos(beta) > 1e-6) {
+        alpha = std::atan2(axes[2].y(), axes[2].z());
+        gamma = std::atan2(axes[1].x(), axes[0].x());
+    } else {
+        alpha = 0.0;
+        gamma = std::atan2(-axes[0].y(), axes[1].y());
+    }
+    return QVector3D(qRadiansToDegrees(alpha), qRadiansToDegrees(beta), qRadiansToDegrees(gamma));
+}
@@ -0,0 +1,27 @@
+#ifndef ORIENTEDBOX_H
+#define ORIENTEDBOX_H
+
+#include <QVector3D>
+#include "convexhull.h"
+
+class OrientedBox
+{
+public:
+    OrientedBox();
+    // Ориентированный ограничивающий параллелепипед минимального объема
+    static OrientedBox compute(const ConvexHull &hull);
+    QVector3D getCenter() const;
+    QVector3D getAxis(int index) const;
+    QVector3D getSize() const;
+    double getVolume() const;
+    // Углы поворота (в градусах) по осям X, Y и Z, совмещающие оси параллелепипеда
+    // с осями координат при повороте в порядке X, Y, Z, как в ModelViewer::rotateModel
+    QVector3D getAlignmentAngles() const;
+
+private:
+    QVector3D center;  // Центр параллелепипеда
+    QVector3D axes[3]; // Оси параллелепипеда (правая тройка, по убыванию размера)
+    QVector3D size;    // Размеры вдоль осей
+};
+
+#endif // ORIENTEDBOX_H
@@ -0,0 +1,235 @@
+#include "slicer.h"
+#include <QFile>
+#include <QTextStream>
+#include <QHash>
+#include <QtConcurrent/QtConcurrent>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+
+namespace {
+
+// Треугольник модели (индексы вершин)
+struct Triangle
+{
+    int a, b, c;
+};
+
+// Отрезок контура, полученный пересечением треугольника с плоскостью.
+// Концы отрезка идентифицируются ребрами модели, на которых они лежат,
+// поэтому соседние треугольники сшиваются без сравнения координат.
+struct Segment
+{
+    quint64 startKey;
+    quint64 endKey;
+    QVector3D start;
+    QVector3D end;
+};
+
+// Ключ ребра, не зависящий от порядка вершин
+quint64 edgeKey(int i, int j) {
+    if (i > j) std::swap(i, j);
+    return (quint64(quint32(i)) << 32) | quint32(j);
+}
+
+// Ориентированная площадь контура в проекции на плоскость XY
+double signedArea(const QVector<QVector3D> &contour) {
+    double area = 0.0;
+    for (int i = 0; i < contour.size(); ++i) {
+        const QVector3D &p = contour[i];
+        const QVector3D &q = contour[(i + 1) % contour.size()];
+        area += double(p.x()) * q.y() - double(q.x()) * p.y();
+    }
+    return area / 2.0;
+}
+
+// Пересечение одного треугольника с плоскостью Z = h.
+// Вершина считается лежащей выше плоскости, если z >= h, поэтому
+// вершины на самой плоскости не дают вырожденных случаев.
+// Направление отрезка определяется обходом треугольника, а не его геометрией:
+// отрезок начинается на ребре, идущем сверху вниз, и заканчивается на ребре,
+// идущем снизу вверх. Тогда внешняя нормаль грани остается справа, внешние
+// контуры обходятся против часовой стрелки, а отверстия - по ней, даже если
+// плоскость проходит через вершину и отрезок вырождается в точку.
+Segment intersectTriangle(const QVector<QVector3D> &vertices, const Triangle &tri, float h) {
+    const int idx[3] = { tri.a, tri.b, tri.c };
+    Segment segment;
+
+    for (int e = 0; e < 3; ++e) {
+        int i = idx[e];
+        int j = idx[(e + 1) % 3];
+        const QVector3D &p = vertices[i];
+        const QVector3D &q = vertices[j];
+        bool pAbove = p.z() >= h;
+        if (pAbove == (q.z() >= h)) continue; // Ребро не пересекает плоскость
+
+        float t = (h - p.z()) / (q.z() - p.z());
+        QVector3D point(p.x() + (q.x() - p.x()) * t, p.y() + (q.y() - p.y()) * t, h);
+        if (pAbove) {
+            segment.startKey = edgeKey(i, j);
+            segment.start = point;
+        } else {
+            segment.endKey = edgeKey(i, j);
+            segment.end = point;
+        }
+    }
+
+    return segment;
+}
+
+// Построение одного сечения по треугольникам, попавшим в его корзину
+void buildSlice(Slice &slice, const QVector<QVector3D> &vertices, const Triangle *triangles,
+                const int *bucket, int bucketSize) {
+    QVector<Segment> segments;
+    segments.reserve(bucketSize);
+    QHash<quint64, int> segmentByStart;
+    segmentByStart.reserve(bucketSize);
+
+    for (int k = 0; k < bucketSize; ++k) {
+        Segment segment = intersectTriangle(vertices, triangles[bucket[k]], slice.z);
+        slice.perimeter += (segment.end - segment.start).length();
+        segmentByStart.insert(segment.startKey, segments.size());
+        segments.append(segment);
+    }
+
+    // Сшиваем отрезки в контуры
+    QVector<bool> used(segments.size(), false);
+    double area = 0.0;
+    for (int first = 0; first < segments.size(); ++first) {
+        if (used[first]) continue;
+
+        QVector<QVector3D> contour;
+        int current = first;
+        bool closed = false;
+        while (true) {
+            used[current] = true;
+            contour.append(segments[current].start);
+            if (segments[current].endKey == segments[first].startKey) {
+                closed = true;
+                break;
+            }
+            int next = segmentByStart.value(segments[current].endKey, -1);
+            if (next < 0 || used[next]) break;
+            current = next;
+        }
+
+        // Незамкнутые контуры (дефекты сетки) учитываются только в периметре
+        if (closed) {
+            area += signedArea(contour);
+        }
+        contour.append(segments[current].end); // Для замкнутого контура совпадает с первой точкой
+        slice.contours.append(contour);
+    }
+
+    slice.area = std::abs(area);
+}
+
+} // namespace
+
+// Метод для сечения модели набором плоскостей Z = const.
+// Треугольники один раз распределяются по корзинам сечений в зависимости от
+// их диапазона по Z, после чего сечения строятся параллельно.
+QVector<Slice> Slicer::slice(const Model &model, const QVector<float> &heights) {
+    const QVector<QVector3D> &vertices = model.getVertices();
+    const QVector<QVector<int>> &faces = model.getFaces();
+
+    QVector<float> sortedHeights = heights;
+    std::sort(sortedHeights.begin(), sortedHeights.end());
+
+    QVector<Slice> slices(sortedHeights.size());
+    for (int i = 0; i < sortedHeights.size(); ++i) {
+        slices[i].z = sortedHeights[i];
+    }
+    if (slices.isEmpty()) return slices;
+
+    // Разбиваем грани на треугольники
+    QVector<Triangle> triangles;
+    for (const QVector<int> &face : faces) {
+        for (int i = 1; i < face.size() - 1; ++i) {
+            triangles.append({ face[0], face[i], face[i + 1] });
+        }
+    }
+
+    // Для каждого треугольника находим диапазон сечений, которые он пересекает:
+    // плоскость Z = h пересекает треугольник, если minZ < h <= maxZ
+    QVector<int> firstSlice(triangles.size());
+    QVector<int> lastSlice(triangles.size());
+    QVector<int> bucketOffsets(slices.size() + 1, 0);
+    for (int t = 0; t < triangles.size(); ++t) {
+        const Triangle &tri = triangles[t];
+        float z0 = vertices[tri.a].z();
+        float z1 = vertices[tri.b].z();
+        float z2 = vertices[tri.c].z();
+        float minZ = qMin(z0, qMin(z1, z2));
+        float maxZ = qMax(z0, qMax(z1, z2));
+
+        firstSlice[t] = std::upper_bound(sortedHeights.begin(), sortedHeights.end(), minZ) - sortedHeights.begin();
+        lastSlice[t] = std::upper_bound(sortedHeights.begin(), sortedHeights.end(), maxZ) - sortedHeights.begin();
+        for (int s = firstSlice[t]; s < lastSlice[t]; ++s) {
+            ++bucketOffsets[s + 1];
+        }
+    }
+
+    // Корзины хранятся в одном массиве, смещения - накопленные суммы
+    for (int s = 0; s < slices.size(); ++s) {
+        bucketOffsets[s + 1] += bucketOffsets[s];
+    }
+    QVector<int> buckets(bucketOffsets.last());
+    QVector<int> fill = bucketOffsets;
+    for (int t = 0; t < triangles.size(); ++t) {
+        for (int s = firstSlice[t]; s < lastSlice[t]; ++s) {
+            buckets[fill[s]++] = t;
+        }
+    }
+
+    // Строим сечения параллельно
+    QVector<int> sliceIndices(slices.size());
+    std::iota(sliceIndices.begin(), sliceIndices.end(), 0);
+    Slice *out = slices.data();
+    const Triangle *triangleData = triangles.constData();
+    const int *bucketData = buckets.constData();
+    const int *offsets = bucketOffsets.constData();
+    QtConcurrent::blockingMap(sliceIndices, [&](const int &s) {
+        buildSlice(out[s], vertices, triangleData, bucketData + offsets[s], offsets[s + 1] - offsets[s]);
+    });
+
+    return slices;
+}
+
+// Метод для получения равномерного набора высот с заданным шагом.
+// Плоскости проходят через середины слоев, чтобы не попадать на основание модели.
+QVector<float> Slicer::uniformHeights(const Model &model, float step) {
+    QVector<float> heights;
+    const QVector<QVector3D> &vertices = model.getVertices();
+    if (vertices.isEmpty() || step <= 0) return heights;
+
+    float minZ = vertices[0].z(), maxZ = vertices[0].z();
+    for (const QVector3D &vertex : vertices) {
+        minZ = qMin(minZ, vertex.z());
+        maxZ = qMax(maxZ, vertex.z());
+    }
+
+    for (int i = 0; minZ + step * (i + 0.5f) < maxZ; ++i) {
+        heights.append(minZ + step * (i + 0.5f));
+    }
+    return heights;
+}
+
+// Метод для экспорта результатов сечения в CSV
+bool Slicer::exportCsv(const QVector<Slice> &slices, const QString &filePath) {
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+        return false;
+
+    QTextStream out(&file);
+    out << "z;area;perimeter;contours\n";
+    for (const Slice &slice : slices) {
+        out << QString::number(slice.z, 'g', 9) << ';'
+            << QString::number(slice.area, 'g', 12) << ';'
+            << QString::number(slice.perimeter, 'g', 12) << ';'
+            << slice.contours.size() << '\n';
+    }
+
+    file.close();
+    return true;
+}
@@ -0,0 +1,29 @@
+#ifndef SLICER_H
+#define SLICER_H
+
+#include <QVector>
+#include <QVector3D>
+#include <QString>
+#include "model.h"
+
+// Результат сечения модели одной горизонтальной плоскостью
+struct Slice
+{
+    float z = 0.0f;                       // Высота плоскости сечения
+    double area = 0.0;                    // Площадь сечения
+    double perimeter = 0.0;               // Суммарная длина контуров
+    QVector<QVector<QVector3D>> contours; // Контуры сечения (у замкнутых последняя точка совпадает с первой)
+};
+
+class Slicer
+{
+public:
+    // Сечение модели набором плоскостей Z = const
+    static QVector<Slice> slice(const Model &model, const QVector<float> &heights);
+    // Равномерный набор высот с заданным шагом по всей высоте модели
+    static QVector<float> uniformHeights(const Model &model, float step);
+    // Экспорт результатов сечения в CSV
+    static bool exportCsv(const QVector<Slice> &slices, const QString &filePath);
+};
+
+#endif // SLICER_H
@@ -0,0 +1,275 @@
+#include "trianglebvh.h"
+#include <QThread>
+#include <QtConcurrent/QtConcurrent>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace {
+
+// Максимальное число треугольников в листе
+const int maxLeafSize = 4;
+
+// Глубина стека обхода; узлы делятся пополам, поэтому 64 уровней достаточно
+const int maxDepth = 64;
+
+QVector3D minVector(const QVector3D &a, const QVector3D &b) {
+    return QVector3D(qMin(a.x(), b.x()), qMin(a.y(), b.y()), qMin(a.z(), b.z()));
+}
+
+QVector3D maxVector(const QVector3D &a, const QVector3D &b) {
+    return QVector3D(qMax(a.x(), b.x()), qMax(a.y(), b.y()), qMax(a.z(), b.z()));
+}
+
+// Квадрат расстояния от точки до параллелепипеда
+float boxDistanceSquared(const QVector3D &point, const QVector3D &min, const QVector3D &max) {
+    float dx = qMax(0.0f, qMax(min.x() - point.x(), point.x() - max.x()));
+    float dy = qMax(0.0f, qMax(min.y() - point.y(), point.y() - max.y()));
+    float dz = qMax(0.0f, qMax(min.z() - point.z(), point.z() - max.z()));
+    return dx * dx + dy * dy + dz * dz;
+}
+
+// Ближайшая к p точка треугольника abc (по областям Вороного вершин, ребер и грани)
+QVector3D closestPointOnTriangle(const QVector3D &p, const QVector3D &a, const QVector3D &b, const QVector3D &c) {
+    QVector3D ab = b - a;
+    QVector3D ac = c - a;
+    QVector3D ap = p - a;
+    float d1 = QVector3D::dotProduct(ab, ap);
+    float d2 = QVector3D::dotProduct(ac, ap);
+    if (d1 <= 0 && d2 <= 0) return a;
+
+    QVector3D bp = p - b;
+    float d3 = QVector3D::dotProduct(ab, bp);
+    float d4 = QVector3D::dotProduct(ac, bp);
+    if (d3 >= 0 && d4 <= d3) return b;
+
+    float vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) return a + ab * (d1 / (d1 - d3));
+
+    QVector3D cp = p - c;
+    float d5 = QVector3D::dotProduct(ab, cp);
+    float d6 = QVector3D::dotProduct(ac, cp);
+    if (d6 >= 0 && d5 <= d6) return c;
+
+    float vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) return a + ac * (d2 / (d2 - d6));
+
+    float va = d3 * d6 - d5 * d4;
+    if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+    float denominator = va + vb + vc;
+    if (denominator == 0) return a; // Вырожденный треугольник
+    return a + ab * (vb / denominator) + ac * (vc / denominator);
+}
+
+} // namespace
+
+// Данные для построения дерева: габариты и центры треугольников
+// и их порядок, который переставляется при делении узлов
+struct TriangleBVH::Builder
+{
+    QVector<QVector3D> boundsMin;
+    QVector<QVector3D> boundsMax;
+    QVector<QVector3D> centers;
+    QVector<int> order;
+
+    int split(Node &node, int begin, int end);
+    void buildSubtree(QVector<Node> &subtree, int begin, int end);
+};
+
+// Заполнение узла для диапазона треугольников. Если диапазон больше листа, он
+// делится пополам по медиане центров вдоль наибольшей стороны их габарита, и
+// возвращается середина; для листа возвращается -1.
+int TriangleBVH::Builder::split(Node &node, int begin, int end) {
+    QVector3D min = boundsMin[order[begin]], max = boundsMax[order[begin]];
+    QVector3D centerMin = centers[order[begin]], centerMax = centerMin;
+    for (int i = begin + 1; i < end; ++i) {
+        int t = order[i];
+        min = minVector(min, boundsMin[t]);
+        max = maxVector(max, boundsMax[t]);
+        centerMin = minVector(centerMin, centers[t]);
+        centerMax = maxVector(centerMax, centers[t]);
+    }
+    node.min = min;
+    node.max = max;
+
+    if (end - begin <= maxLeafSize) {
+        node.first = begin;
+        node.count = end - begin;
+        return -1;
+    }
+
+    QVector3D extent = centerMax - centerMin;
+    int axis = 0;
+    if (extent.y() > extent[axis]) axis = 1;
+    if (extent.z() > extent[axis]) axis = 2;
+
+    int middle = (begin + end) / 2;
+    const QVector<QVector3D> &c = centers;
+    std::nth_element(order.begin() + begin, order.begin() + middle, order.begin() + end, [&c, axis](int a, int b) {
+        return c[a][axis] < c[b][axis];
+    });
+    node.count = 0;
+    return middle;
+}
+
+// Построение поддерева в отдельный массив узлов (корень - первый элемент)
+void TriangleBVH::Builder::buildSubtree(QVector<Node> &subtree, int begin, int end) {
+    struct Range
+    {
+        int node;
+        int begin;
+        int end;
+    };
+    subtree.append(Node());
+    QVector<Range> stack = { { 0, begin, end } };
+    while (!stack.isEmpty()) {
+        Range range = stack.last();
+        stack.removeLast();
+
+        int middle = split(subtree[range.node], range.begin, range.end);
+        if (middle < 0) continue;
+
+        int left = subtree.size();
+        subtree[range.node].first = left;
+        subtree.append(Node());
+        subtree.append(Node());
+        stack.append({ left, range.begin, middle });
+        stack.append({ left + 1, middle, range.end });
+    }
+}
+
+// Конструктор: построение дерева. Верхние уровни делятся последовательно,
+// пока не наберется достаточно независимых поддеревьев, которые затем
+// строятся параллельно и дописываются в общий массив узлов.
+TriangleBVH::TriangleBVH(const Model &model) {
+    const QVector<QVector3D> &vertices = model.getVertices();
+
+    // Разбиваем грани на треугольники
+    int triangleCount = 0;
+    for (const QVector<int> &face : model.getFaces()) {
+        triangleCount += qMax(0, int(face.size()) - 2);
+    }
+    QVector<Triangle> source;
+    source.reserve(triangleCount);
+    for (const QVector<int> &face : model.getFaces()) {
+        for (int i = 1; i < face.size() - 1; ++i) {
+            source.append({ vertices[face[0]], vertices[face[i]], vertices[face[i + 1]] });
+        }
+    }
+    if (source.isEmpty()) return;
+
+    Builder builder;
+    builder.boundsMin.resize(source.size());
+    builder.boundsMax.resize(source.size());
+    builder.centers.resize(source.size());
+    builder.order.resize(source.size());
+    for (int i = 0; i < source.size(); ++i) {
+        const Triangle &tri = source[i];
+        builder.boundsMin[i] = minVector(tri.a, minVector(tri.b, tri.c));
+        builder.boundsMax[i] = maxVector(tri.a, maxVector(tri.b, tri.c));
+        builder.centers[i] = (builder.boundsMin[i] + builder.boundsMax[i]) / 2.0f;
+    }
+    std::iota(builder.order.begin(), builder.order.end(), 0);
+
+    struct Task
+    {
+        int node;
+        int begin;
+        int end;
+        QVector<Node> subtree;
+    };
+    int taskTarget = qMax(1, QThread::idealThreadCount() * 4);
+    nodes.append(Node());
+    QVector<Task> tasks = { { 0, 0, int(source.size()), QVector<Node>() } };
+    while (!tasks.isEmpty() && tasks.size() < taskTarget) {
+        QVector<Task> next;
+        for (const Task &task : tasks) {
+            int middle = builder.split(nodes[task.node], task.begin, task.end);
+            if (middle < 0) continue;
+
+            int left = nodes.size();
+            nodes[task.node].first = left;
+            nodes.append(Node());
+            nodes.append(Node());
+            next.append({ left, task.begin, middle, QVector<Node>() });
+            next.append({ left + 1, middle, task.end, QVector<Node>() });
+        }
+        tasks = next;
+    }
+
+    QtConcurrent::blockingMap(tasks, [&builder](Task &task) {
+        builder.buildSubtree(task.subtree, task.begin, task.end);
+    });
+
+    // Корень поддерева встает на место узла задачи, остальные узлы
+    // дописываются в конец со сдвигом ссылок на детей
+    for (const Task &task : tasks) {
+        int offset = nodes.size() - 1;
+        for (int k = 0; k < task.subtree.size(); ++k) {
+            Node node = task.subtree[k];
+            if (node.count == 0) node.first += offset;
+            if (k == 0) {
+                nodes[task.node] = node;
+            } else {
+                nodes.append(node);
+            }
+        }
+    }
+
+    // Переставляем треугольники в порядке листьев
+    triangles.resize(source.size());
+    for (int i = 0; i < source.size(); ++i) {
+        triangles[i] = source[builder.order[i]];
+    }
+}
+
+// Метод для проверки, есть ли в дереве треугольники
+bool TriangleBVH::isEmpty() const {
+    return nodes.isEmpty();
+}
+
+// Метод для поиска ближайшей точки поверхности. Узлы обходятся от ближнего
+// к дальнему, и узлы дальше уже найденного расстояния отбрасываются.
+float TriangleBVH::closestDistance(const QVector3D &point, QVector3D *closestPoint) const {
+    float best = std::numeric_limits<float>::max();
+    if (nodes.isEmpty()) return best;
+
+    QVector3D bestPoint;
+    int stack[maxDepth];
+    int size = 0;
+    stack[size++] = 0;
+    while (size > 0) {
+        const Node &node = nodes[stack[--size]];
+        if (boxDistanceSquared(point, node.min, node.max) >= best) continue;
+
+        if (node.count > 0) {
+            for (int i = node.first; i < node.first + node.count; ++i) {
+                const Triangle &tri = triangles[i];
+                QVector3D candidate = closestPointOnTriangle(point, tri.a, tri.b, tri.c);
+                float distance = (candidate - point).lengthSquared();
+                if (distance < best) {
+                    best = distance;
+                    bestPoint = candidate;
+                }
+            }
+            continue;
+        }
+
+        // Ближний ребенок кладется в стек последним, чтобы обойти его первым
+        int nearChild = node.first;
+        int farChild = node.first + 1;
+        float nearDistance = boxDistanceSquared(point, nodes[nearChild].min, nodes[nearChild].max);
+        float farDistance = boxDistanceSquared(point, nodes[farChild].min, nodes[farChild].max);
+        if (farDistance < nearDistance) {
+            std::swap(nearChild, farChild);
+            std::swap(nearDistance, farDistance);
+        }
+        if (farDistance < best) stack[size++] = farChild;
+        if (nearDistance < best) stack[size++] = nearChild;
+    }
+
+    if (closestPoint) *closestPoint = bestPoint;
+    return std::sqrt(best);
+}
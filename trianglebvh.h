@@ -0,0 +1,39 @@
+#ifndef TRIANGLEBVH_H
+#define TRIANGLEBVH_H
+
+#include <QVector>
+#include <QVector3D>
+#include "model.h"
+
+// Иерархия ограничивающих объемов (AABB) над треугольниками модели
+// для быстрого поиска ближайшей точки поверхности
+class TriangleBVH
+{
+public:
+    explicit TriangleBVH(const Model &model);
+    bool isEmpty() const;
+    // Расстояние от точки до ближайшей точки поверхности модели
+    float closestDistance(const QVector3D &point, QVector3D *closestPoint = nullptr) const;
+
+private:
+    struct Triangle
+    {
+        QVector3D a, b, c;
+    };
+
+    // Узел дерева. Лист хранит count > 0 треугольников, начиная с first;
+    // у внутреннего узла count == 0, а дети лежат подряд, начиная с first.
+    struct Node
+    {
+        QVector3D min, max;
+        int first;
+        int count;
+    };
+
+    struct Builder;
+
+    QVector<Triangle> triangles;
+    QVector<Node> nodes;
+};
+
+#endif // TRIANGLEBVH_H
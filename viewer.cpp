@@ -5,7 +5,7 @@
 #include <QWheelEvent>
 
 Viewer::Viewer(QWidget *parent)
-    : QWidget(parent), model(nullptr), rotationX(0), rotationY(0), scale(1.0), selectedVertexIndex(-1)
+    : QWidget(parent), model(nullptr), maxDeviation(0), rotationX(0), rotationY(0), scale(1.0), selectedVertexIndex(-1)
 {
     setMinimumSize(400, 400);
     setMouseTracking(true);
@@ -21,6 +21,33 @@ void Viewer::setScale(float scale) {
     update();
 }
 
+void Viewer::setSlices(const QVector<Slice> &slices) {
+    this->slices = slices;
+    update();
+}
+
+void Viewer::setDeviations(const QVector<float> &deviations, float maxDeviation) {
+    this->deviations = deviations;
+    this->maxDeviation = maxDeviation;
+    update();
+}
+
+QColor Viewer::deviationColor(float deviation) const {
+    // От синего (нет отклонения) до красного (максимальное отклонение)
+    float t = maxDeviation > 0 ? qBound(0.0f, deviation / maxDeviation, 1.0f) : 0.0f;
+    return QColor::fromHsvF((1.0f - t) * 2.0f / 3.0f, 1.0f, 1.0f);
+}
+
+QPointF Viewer::projectVertex(const QVector3D &vertex) const {
+    // Применяем поворот и масштабирование
+    float x = vertex.x() * cos(rotationY) - vertex.z() * sin(rotationY);
+    float z = vertex.x() * sin(rotationY) + vertex.z() * cos(rotationY);
+    float y = vertex.y() * cos(rotationX) - z * sin(rotationX);
+
+    // Преобразуем координаты в экранные
+    return QPointF((x * scale) + width() / 2, height() / 2 - (y * scale));
+}
+
 void Viewer::paintEvent(QPaintEvent *event) {
     Q_UNUSED(event);
 
@@ -77,6 +104,10 @@ void Viewer::paintEvent(QPaintEvent *event) {
             painter.setPen(QPen(Qt::red, 4));
             painter.drawEllipse(point, 5, 5);
             painter.setPen(QPen(Qt::black, 2));
+        } else if (deviations.size() == vertices.size()) {
+            painter.setPen(QPen(deviationColor(deviations[i]), 2));
+            painter.drawEllipse(point, 3, 3);
+            painter.setPen(QPen(Qt::black, 2));
         } else {
             painter.drawEllipse(point, 3, 3);
         }
@@ -102,6 +133,18 @@ void Viewer::paintEvent(QPaintEvent *event) {
         }
         painter.drawPolygon(polygon); // Рисуем грань
     }
+
+    // Отрисовываем контуры сечений
+    painter.setPen(QPen(Qt::red, 2));
+    for (const Slice &slice : slices) {
+        for (const QVector<QVector3D> &contour : slice.contours) {
+            QPolygonF polyline;
+            for (const QVector3D &point : contour) {
+                polyline << projectVertex(point);
+            }
+            painter.drawPolyline(polyline);
+        }
+    }
 }
 
 void Viewer::mousePressEvent(QMouseEvent *event) {
@@ -2,7 +2,9 @@
 #define VIEWER_H
 
 #include <QWidget>
+#include <QColor>
 #include "model.h"
+#include "slicer.h"
 
 class Viewer : public QWidget
 {
@@ -12,6 +14,8 @@ public:
     explicit Viewer(QWidget *parent = nullptr);
     void setModel(Model *model);
     void setScale(float scale);
+    void setSlices(const QVector<Slice> &slices); // Контуры сечений для отображения поверх модели
+    void setDeviations(const QVector<float> &deviations, float maxDeviation); // Отклонения вершин для цветовой карты
 
 signals:
     void vertexSelected(int index, const QVector3D &vertex); // Сигнал для передачи информации о выделенной вершине
@@ -23,7 +27,13 @@ protected:
     void wheelEvent(QWheelEvent *event) override;
 
 private:
+    QPointF projectVertex(const QVector3D &vertex) const; // Перевод точки модели в экранные координаты
+    QColor deviationColor(float deviation) const; // Цвет вершины на карте отклонений
+
     Model *model;
+    QVector<Slice> slices;
+    QVector<float> deviations;
+    float maxDeviation;
     QPointF lastMousePosition; // Изменяем тип на QPointF
     float rotationX;
     float rotationY;